@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "AuxKernel.h"
+
+#include "NEMLHistory.h"
+
+/**
+ * Pull several NEML internal state variables into the components of an array
+ * AuxVariable in one pass over the history storage. The offsets of the
+ * variables are resolved once from the coupled NEML stress material.
+ */
+class NEMLStateArrayAux : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  NEMLStateArrayAux(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  /// A reference to the NEML flat history vector
+  const MaterialProperty<NEMLHistory> & _neml_history;
+  /// Names of the NEML state variables to pull, one per component
+  const std::vector<std::string> _state_variables;
+
+  /// Offsets of the variables into the flat NEML state
+  std::vector<std::size_t> _offsets;
+  /// Size of the flat NEML state
+  std::size_t _nstore;
+};
@@ -16,6 +16,8 @@
 
 #include "AuxKernel.h"
 
+#include "NEMLHistory.h"
+
 #include "neml_interface.h"
 
 /// Pull a NEML internal state variable into an AuxVariable
@@ -26,21 +28,22 @@ public:
 
   NEMLStateAux(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
+  /// The model of a NEML stress material, nullptr if the material does not use NEML
+  static std::shared_ptr<neml::NEMLModel> materialModel(MaterialBase & material);
+
 protected:
   virtual Real computeValue() override;
 
 protected:
-  /// File name for the NEML model
-  FileName _fname;
-  /// Name of the NEML model in the file
-  std::string _mname;
   /// A reference to the NEML flat history vector
-  const MaterialProperty<std::vector<Real>> & _neml_history;
+  const MaterialProperty<NEMLHistory> & _neml_history;
   /// Name of the NEML state variable to pull
   std::string _var_name;
 
-  /// Stored pointer to the NEML model
-  std::unique_ptr<neml::NEMLModel> _model;
+  /// Stored pointer to the NEML model, shared with the stress material
+  std::shared_ptr<neml::NEMLModel> _model;
 
   /// Stored offset of the variable into the flat NEML state
   size_t _offset;
@@ -0,0 +1,29 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "AuxKernel.h"
+
+class TemperatureArchiveReader;
+
+/// Nodal temperature read from a TemperatureArchive, e.g. to couple to CauchyStressFromNEML
+class TemperatureArchiveAux : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  TemperatureArchiveAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  /// Reader interpolating the archive at the current time
+  const TemperatureArchiveReader & _reader;
+};
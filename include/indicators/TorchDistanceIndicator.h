@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Indicator.h"
+
+class FunctionPathDiffusedEllipsoidHeatSource;
+
+/**
+ * Distance of each element from a moving FunctionPathDiffusedEllipsoidHeatSource, in ellipsoid
+ * radii, minimised over a time window around the current time.
+ */
+class TorchDistanceIndicator : public Indicator
+{
+public:
+  static InputParameters validParams();
+
+  TorchDistanceIndicator(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void computeIndicator() override;
+
+protected:
+  MooseVariable & _field_var;
+  const Elem * const & _current_elem;
+
+  /// Name of the heat source material
+  const MaterialName & _heat_source_name;
+  /// Heat source providing the torch path and shape
+  const FunctionPathDiffusedEllipsoidHeatSource * _heat_source;
+
+  ///@{ Time window [t - lag, t + lookahead] sampled at the given number of times
+  const Real _lag;
+  const Real _lookahead;
+  const unsigned int _samples;
+  ///@}
+};
@@ -0,0 +1,32 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "IndicatorMarker.h"
+
+/**
+ * Refine the elements close to a moving torch and coarsen the elements far from it, using a
+ * TorchDistanceIndicator.
+ */
+class TorchDistanceMarker : public IndicatorMarker
+{
+public:
+  static InputParameters validParams();
+
+  TorchDistanceMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  /// Refine elements closer than this many ellipsoid radii
+  const Real _refine;
+  /// Coarsen elements further than this many ellipsoid radii
+  const Real _coarsen;
+};
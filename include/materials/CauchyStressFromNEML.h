@@ -16,9 +16,15 @@
 
 #include "ComputeLagrangianStressCauchy.h"
 
+#include "CallTimer.h"
+#include "NEMLBatchUpdate.h"
+#include "NEMLHistory.h"
+#include "NEMLStateArchive.h"
+#include "StatisticsInterface.h"
+
 #include "neml_interface.h"
 
-class CauchyStressFromNEML : public ComputeLagrangianStressCauchy
+class CauchyStressFromNEML : public ComputeLagrangianStressCauchy, public StatisticsInterface
 {
 public:
   static InputParameters validParams();
@@ -35,20 +41,39 @@ public:
    */
   std::vector<unsigned int> provide_indices(const std::vector<std::string> & to_reset);
 
+  /// The NEML model, shared with other objects on this thread
+  const std::shared_ptr<neml::NEMLModel> & model() const { return _model; }
+
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpCauchyStress();
   virtual void initQpStatefulProperties();
 
+  /// Pack the inputs of quadrature points [qp, qp + n) into the batch
+  void gatherQps(unsigned int qp, unsigned int n);
+  /// Update the whole batch with NEML
+  void updateBatch();
+  /// Copy the results of batch entry i to quadrature point qp
+  void scatterQp(unsigned int qp, std::size_t i);
+
 protected:
   FileName _fname;
   std::string _mname;
-  std::unique_ptr<neml::NEMLModel> _model;
+  std::shared_ptr<neml::NEMLModel> _model;
+  /// Initial history of the model, used to initialize and reset the state
+  NEMLHistory _init_history;
 
   const VariableValue & _temperature;
   const VariableValue & _temperature_old;
 
-  MaterialProperty<std::vector<Real>> & _history;
-  const MaterialProperty<std::vector<Real>> & _history_old;
+  MaterialProperty<NEMLHistory> & _history;
+  const MaterialProperty<NEMLHistory> & _history_old;
 
   MaterialProperty<Real> & _energy;
   const MaterialProperty<Real> & _energy_old;
@@ -68,11 +93,31 @@ protected:
   MaterialProperty<RankTwoTensor> & _elastic_strain;
 
   MaterialProperty<Real> & _dissipation_rate;
-};
 
-/// Tensor -> skew vector
-void rankTwoSkewToNEML(const RankTwoTensor & in, double * const out);
-
-/// Skew + symmetric parts to full tangent
-void
-recombineTangentNEML(const double * const Dpart, const double * const Wpart, RankFourTensor & out);
+  /// Update all quadrature points of an element in one batch
+  const bool _batch_qps;
+  /// Packed NEML inputs and outputs
+  NEMLBatchUpdate _batch;
+  /// Whether _batch holds the results for all quadrature points of the current element
+  bool _batch_ready;
+
+  /// Only recombine the tangent when the Jacobian is being computed
+  const bool _skip_residual_tangent;
+
+  /// Calls and time spent in computeProperties since the beginning of the time step
+  CallTimer _timer;
+
+  ///@{ Elastic predictor for quadrature points in quiescent regions
+  const bool _elastic_predictor;
+  const Real _predictor_temperature_tolerance;
+  const Real _predictor_strain_tolerance;
+  const unsigned int _max_predicted_steps;
+  /// Consecutive time steps updated with the predictor, -1 if the last full update dissipated
+  MaterialProperty<Real> * _predicted_steps;
+  const MaterialProperty<Real> * _predicted_steps_old;
+  ///@}
+
+  /// State written by NEMLStateCheckpoint to start from instead of the initial NEML state, shared
+  /// by all copies of the material and released once the stateful properties are initialized
+  std::shared_ptr<const NEMLStateArchive> _initial_state;
+};
@@ -10,67 +10,189 @@
 #pragma once
 
 #include "Material.h"
+#include "Function.h"
+#include "StatisticsInterface.h"
+#include "CallTimer.h"
+#include "DiffusedEllipsoidKernel.h"
 
-class Function;
+#include "libmesh/bounding_box.h"
 
 /**
  * Diffused Goldak ellipsoid heat source distribution.
  */
-class FunctionPathDiffusedEllipsoidHeatSource : public Material
+class FunctionPathDiffusedEllipsoidHeatSource : public Material, public StatisticsInterface
 {
 public:
   static InputParameters validParams();
 
   FunctionPathDiffusedEllipsoidHeatSource(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void computeProperties() override;
+
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
+  /**
+   * Distance of a point from the torch at time t, in ellipsoid radii and measured from the
+   * segment swept by the weave, so that each term of calc_va is at most exp(-d^2)
+   * @param p point
+   * @param margin radius of a ball around p to account for, e.g. half the element diagonal
+   * @param t time to evaluate the torch path at
+   */
+  Real torchDistance(const Point & p, Real margin, Real t) const;
+
 protected:
   virtual void computeQpProperties() override;
 
-  /// heat source path
-  const Real _path_x;
-  const Real _path_y;
-  const Real _path_z;
+  /// A scalar input given either as a constant or as a function of time
+  struct TimeParameter
+  {
+    Real value;
+    const Function * function;
+
+    Real operator()(Real t) const { return function ? function->value(t) : value; }
+  };
+
+  /// Heat source parameters evaluated at a single time
+  struct TorchState
+  {
+    Real path_x;
+    Real path_y;
+    Real path_z;
+    Real rx;
+    Real ry;
+    Real rz;
+    Real power;
+    Real efficiency;
+    Real tilt;
+    Real weave_x;
+    Real weave_y;
+    Real weave_z;
+    Real va;
+
+    ///@{ Derived quantities shared by all quadrature points
+    Real cos_tilt;
+    Real sin_tilt;
+    DiffusedEllipsoidKernel::Shape shape;
+    ///@}
+  };
+
+  /// Choose between the constant, the function or the default value of a parameter
+  TimeParameter resolveParameter(const std::string & name,
+                                 const std::string & function_name,
+                                 Real default_value);
+
+  /// Evaluate the torch parameters at time t
+  void evaluateTorch(Real t, TorchState & torch) const;
+
+  /// Evaluate the torch state at the current time if it is not cached already
+  void updateTorchState();
+
+  /// Number of Gaussian terms summed into calc_va for the current torch state
+  unsigned int numTerms() const;
+
+  /// Whether the region around the torch extends outside of the mesh
+  bool torchClipped() const;
+
+  /// Whether the blocks of the material fill the bounding box of the mesh (collective)
+  bool meshFillsBox() const;
+
+  /// Whether this is the block material of the first thread, which integrates calc_va
+  bool isPrimary() const;
+
+  /// Update the built-in normalisation on the primary copy, integrating calc_va if the torch is
+  /// clipped (collective)
+  void updateNormalisation();
+
+  /// Integral of calc_va over the elements around the torch (collective)
+  Real integrateCalcVa();
+
+  /// Evaluate calc_va at all quadrature points of the current element into _qp_calc_va
+  void evaluateBatch();
+
+  /// Coordinates of a point relative to the torch centre in the tilted frame
+  void torchFrame(const Point & p, Real & x_rot, Real & y_rot, Real & dz) const;
 
-  const Function & _function_path_x;
-  const Function & _function_path_y;
-  const Function & _function_path_z;
+  /// heat source path
+  const TimeParameter _path_x;
+  const TimeParameter _path_y;
+  const TimeParameter _path_z;
 
   /// heat source dimensions
-  const Real _rx;
-  const Real _ry;
-  const Real _rz;
-
-  const Function & _function_rx;
-  const Function & _function_ry;
-  const Function & _function_rz;
+  const TimeParameter _rx;
+  const TimeParameter _ry;
+  const TimeParameter _rz;
 
   /// heat source power
-  const Real _power;
-  const Real _efficiency;
-
-  const Function & _function_power;
-  const Function & _function_efficiency;
+  const TimeParameter _power;
+  const TimeParameter _efficiency;
 
   /// heat source tilt
-  const Real _tilt;
-  const Function & _function_tilt;
+  const TimeParameter _tilt;
 
   /// heat source weaves
-  const Real _weave_amp_x;
-  const Function & _function_weave_amp_x;
-  const Real _weave_amp_y;
-  const Function & _function_weave_amp_y;
-  const Real _weave_amp_z;
-  const Function & _function_weave_amp_z;
+  const TimeParameter _weave_amp_x;
+  const TimeParameter _weave_amp_y;
+  const TimeParameter _weave_amp_z;
 
   /// half model
   const bool _half_model;
 
   /// volumetric heat source calculation
   ADMaterialProperty<Real> & _calc_va;
-  const Real _va;
-  const Function & _function_va;
+  const bool _analytic_va;
+  const bool _va_from_pp;
+  const TimeParameter _va;
   const PostprocessorValue & _pp_va;
   ADMaterialProperty<Real> & _volumetric_heat;
 
+  /// Torch state cached for the time it was last evaluated at
+  TorchState _torch;
+  Real _torch_time;
+  bool _torch_valid;
+
+  ///@{ Skip elements further than a cutoff (in ellipsoid radii) from the torch
+  const bool _cull;
+  const Real _cull_cutoff;
+  /// Evaluate culled elements anyway to measure the neglected calc_va
+  const bool _check_culling;
+  libMesh::BoundingBox _active_box;
+  ///@}
+
+  ///@{ Built-in normalisation, integrated around the torch when it is clipped by the mesh
+  libMesh::BoundingBox _mesh_box;
+  /// Whether the blocks of the material fill _mesh_box, so that the box decides the clipping (set
+  /// on the primary copy)
+  bool _mesh_is_box;
+  bool _torch_clipped;
+  /// Copy of the material that integrates calc_va for all the others
+  const FunctionPathDiffusedEllipsoidHeatSource * _primary;
+  Real _clipped_va;
+  Real _clipped_va_time;
+  unsigned long _n_integrations;
+  ///@}
+
+  ///@{ calc_va at all quadrature points of the current element, evaluated in one batch
+  std::vector<Real> _qp_x;
+  std::vector<Real> _qp_y;
+  std::vector<Real> _qp_z;
+  std::vector<Real> _qp_calc_va;
+  bool _batch_computed;
+  ///@}
+
+  ///@{ Element evaluations (residual and Jacobian alike) since the beginning of the time step,
+  /// with the element culled or evaluated in full
+  unsigned long _n_culled_evaluations;
+  unsigned long _n_full_evaluations;
+  ///@}
+  /// Largest calc_va at a culled quadrature point since the beginning of the time step
+  Real _max_culled_calc_va;
+
+  /// Calls and time spent in computeProperties since the beginning of the time step
+  CallTimer _timer;
+  /// PerfGraph section of the (collective) clipped normalisation integral
+  const PerfID _integrate_section;
 };
@@ -16,6 +16,11 @@
 
 #include "ComputeStressBase.h"
 
+#include "CallTimer.h"
+#include "NEMLBatchUpdate.h"
+#include "NEMLHistory.h"
+#include "StatisticsInterface.h"
+
 #include "neml_interface.h"
 
 /**
@@ -23,44 +28,31 @@
  * compute the stress, and track dissipation and strain energy.
  */
 
-class NEMLStressBase : public ComputeStressBase
+class NEMLStressBase : public ComputeStressBase, public StatisticsInterface
 {
 public:
   static InputParameters validParams();
   NEMLStressBase(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+  virtual void computeProperties() override;
   virtual void computeQpStress() override;
   virtual void initQpStatefulProperties() override;
 
-  /**
-   * Translates a RankTwoTensor object to a NEML tensor stored in a vector
-   * format.
-   * @param in  RankTwoTensor to be translated
-   * @param out NEML vector output
-   */
-  static void rankTwoTensorToNeml(const RankTwoTensor & in, double * const out);
-
-  /**
-   * Translates a NEML tensor stored in vector format to a RankTwoTensor.
-   * @param in  NEML vector to be translated
-   * @param out RankTwoTensor output
-   */
-  static void nemlToRankTwoTensor(const double * const in, RankTwoTensor & out);
-
-  /**
-   * Translates a NEML elasticity tensor to a RankFourTensor.
-   * @param in  NEML elasticity tensor to be translated
-   * @param out RankFourTensor output
-   */
-  static void nemlToRankFourTensor(const double * const in, RankFourTensor & out);
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
+  /// The NEML model, shared with other objects on this thread
+  const std::shared_ptr<neml::NEMLModel> & model() const { return _model; }
 
 protected:
   /// NEML model
-  std::unique_ptr<neml::NEMLModel> _model;
+  std::shared_ptr<neml::NEMLModel> _model;
 
   ///@{ History variables used by NEML model
-  MaterialProperty<std::vector<Real>> & _hist;
-  const MaterialProperty<std::vector<Real>> & _hist_old;
+  MaterialProperty<NEMLHistory> & _hist;
+  const MaterialProperty<NEMLHistory> & _hist_old;
   ///@}
 
   /// Old mechanical strain
@@ -98,4 +90,23 @@ protected:
   MaterialProperty<Real> * _damage_index;
   /// Print debugging data on failed NEML stress updates
   const bool _debug;
+
+  /// Packed NEML inputs and outputs of the current quadrature point, with substepping
+  NEMLBatchUpdate _batch;
+
+  /// Only convert the tangent when the Jacobian is being computed
+  const bool _skip_residual_tangent;
+
+  /// Calls and time spent in computeProperties since the beginning of the time step
+  CallTimer _timer;
+
+  ///@{ Elastic predictor for quadrature points in quiescent regions
+  const bool _elastic_predictor;
+  const Real _predictor_temperature_tolerance;
+  const Real _predictor_strain_tolerance;
+  const unsigned int _max_predicted_steps;
+  /// Consecutive time steps updated with the predictor, -1 if the last full update dissipated
+  MaterialProperty<Real> * _predicted_steps;
+  const MaterialProperty<Real> * _predicted_steps_old;
+  ///@}
 };
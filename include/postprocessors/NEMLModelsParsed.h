@@ -0,0 +1,36 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/// Number of NEML models parsed by the model cache, maximum over all processors
+class NEMLModelsParsed : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  NEMLModelsParsed(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  /// Whether to report the count per thread
+  const bool _per_thread;
+  Real _value;
+};
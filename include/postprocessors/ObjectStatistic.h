@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class StatisticsInterface;
+
+/// Reduce a statistic kept by a material or user object over all threads and processors
+class ObjectStatistic : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ObjectStatistic(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  /// Thread-local copy of the material, or the (joined) user object, providing the statistic
+  const StatisticsInterface & provider(THREAD_ID tid) const;
+
+  /// Name of the material providing the statistic
+  const MaterialName * const _material_name;
+  /// User object providing the statistic instead of a material
+  const StatisticsInterface * const _user_object;
+  /// Name of the statistic to report
+  const std::string & _statistic;
+  /// Reduction over threads and processors
+  const MooseEnum _reduction;
+  /// Whether the per-processor sums are reduced over processors with min, max or mean
+  const bool _over_ranks;
+
+  Real _value;
+};
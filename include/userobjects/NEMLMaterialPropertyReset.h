@@ -11,9 +11,12 @@
 
 #include "ElementUserObject.h"
 #include "CauchyStressFromNEML.h"
+#include "StatisticsInterface.h"
+#include "CallTimer.h"
+#include "NEMLResetRule.h"
 
 /// Reset a NEML state variable when a coupled variable hits a critical value
-class NEMLMaterialPropertyReset : public ElementUserObject
+class NEMLMaterialPropertyReset : public ElementUserObject, public StatisticsInterface
 {
 public:
   static InputParameters validParams();
@@ -26,6 +29,9 @@ public:
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
 
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
 protected:
   /// Check the temperature and reset history if needed
   virtual void resetQp();
@@ -39,6 +45,8 @@ protected:
   const Real _critical_value;
   const Real _lower_value;
   const Real _upper_value;
+  /// Reset decision from the values above
+  const NEMLResetRule _rule;
   /// List of NEML model properties to reset
   std::vector<std::string> _props;
   /// NEML material model class to link to
@@ -46,6 +54,21 @@ protected:
   /// Cached list of indices
   std::vector<unsigned int> _indices;
 
+  /// Degrees of freedom of the coupled variable on the current element
+  const VariableValue & _variable_dofs;
+  /// Whether the largest degree of freedom bounds the values at the quadrature points, so that
+  /// elements whose degrees of freedom are all below the activity threshold can be skipped
+  bool _mask;
+  /// Values below this never trigger an action
+  const Real _activity_threshold;
+
+  ///@{ Counts for the current execution
+  unsigned long _n_reset;
+  unsigned long _n_const;
+  unsigned long _n_skipped_elements;
+  CallTimer _timer;
+  ///@}
+
 private:
   unsigned int _qp;
 };
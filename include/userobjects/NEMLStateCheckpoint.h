@@ -0,0 +1,100 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "StatisticsInterface.h"
+#include "CallTimer.h"
+#include "NEMLHistory.h"
+
+#include <future>
+#include <unordered_map>
+
+/**
+ * Write the NEML material state of CauchyStressFromNEML to a NEMLStateArchive.
+ * Only the elements whose packed state changed since the previous frame are
+ * written, and the frame is compressed and appended to the file on a
+ * background thread while the solve continues. The final execution waits for
+ * the last frame and reports any write error.
+ *
+ * The archive is a compact record of the state to start a new run from, e.g.
+ * the next pass of a weld, through the initial_state of CauchyStressFromNEML.
+ * It is written alongside the MOOSE checkpoint, which still holds the stateful
+ * properties and remains the way to recover an interrupted run.
+ */
+class NEMLStateCheckpoint : public ElementUserObject, public StatisticsInterface
+{
+public:
+  static InputParameters validParams();
+
+  NEMLStateCheckpoint(const InputParameters & parameters);
+  virtual ~NEMLStateCheckpoint();
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
+protected:
+  /// Wait for the previous frame to be written, reporting its write error if any
+  void waitForWrite();
+
+  /// Base name of the NEML material properties
+  const std::string _base_name;
+
+  /// Stateful properties of the NEML material
+  const MaterialProperty<NEMLHistory> & _history;
+  const MaterialProperty<Real> & _energy;
+  const MaterialProperty<Real> & _dissipation;
+  const MaterialProperty<RankTwoTensor> & _stress;
+  const MaterialProperty<RankTwoTensor> & _linear_rotation;
+
+  /// Archive file of this processor
+  const std::string _file;
+  /// Time steps between frames
+  const unsigned int _interval;
+  /// Compress the frames
+  const bool _compress;
+
+  /// Whether a frame is written in this execution
+  bool _due;
+  /// Whether the archive of an interrupted run still has to be cut back to the recovered step
+  bool _recovering;
+  /// Packed records of all elements of this thread, joined into thread 0
+  std::vector<char> _buffer;
+  /// History size of the packed records
+  std::size_t _nstore;
+
+  /// Hash of the last record written for each element, and the number of the frame it was written
+  /// or checked in
+  struct Written
+  {
+    std::uint64_t hash;
+    std::uint64_t frame;
+  };
+  std::unordered_map<dof_id_type, Written> _written;
+  /// Frames written by this processor
+  std::uint64_t _frames;
+
+  /// Frame being written in the background
+  std::future<void> _pending;
+
+  ///@{ Counts for the last frame
+  unsigned long _n_written;
+  unsigned long _n_unchanged;
+  /// Size of the records before compression
+  unsigned long _bytes;
+  /// Time the solve spent packing the state and waiting for the previous frame
+  CallTimer _timer;
+  ///@}
+};
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "StatisticsInterface.h"
+#include "TemperatureArchive.h"
+
+#include <memory>
+
+/**
+ * Nodal temperatures interpolated in time from a TemperatureArchive written by
+ * TemperatureArchiveWriter, for TemperatureArchiveAux. Each execution finds
+ * the two frames around the current time and asks for the following frames to
+ * be read ahead. If the thermal run has not reached the current time yet, the
+ * reader waits for it to append the frames, up to a timeout, so that the
+ * thermal and mechanical runs can go on at the same time. Nodes are matched
+ * by id, so both runs must use the same mesh with the same numbering.
+ */
+class TemperatureArchiveReader : public GeneralUserObject, public StatisticsInterface
+{
+public:
+  static InputParameters validParams();
+
+  TemperatureArchiveReader(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// Temperature of a node at the time of the last execution
+  Real value(dof_id_type node_id) const;
+
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
+protected:
+  /// Archive file
+  const FileName _file;
+  /// Frames read ahead of the current time
+  const unsigned int _prefetch;
+  /// Longest time to wait for the thermal run, in seconds
+  const Real _timeout;
+
+  std::unique_ptr<TemperatureArchive> _archive;
+
+  ///@{ Frames around the current time and the weight of the second one
+  std::size_t _frame0;
+  std::size_t _frame1;
+  Real _weight;
+  ///@}
+
+  /// Time spent waiting for the thermal run in the last execution
+  Real _wait;
+};
@@ -0,0 +1,78 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "NodalUserObject.h"
+#include "StatisticsInterface.h"
+#include "CallTimer.h"
+
+#include <future>
+#include <unordered_map>
+
+/**
+ * Append the nodal temperatures of each time step to a TemperatureArchive,
+ * so that a mechanical run can read them with TemperatureArchiveReader while
+ * the thermal run carries on. The values are gathered on the first processor,
+ * which writes the frame on a background thread. The node ids are only gathered
+ * with the first frame, each processor then sends its values in the order of
+ * its sorted node ids. The final execution waits for the last frame and
+ * reports any write error.
+ */
+class TemperatureArchiveWriter : public NodalUserObject, public StatisticsInterface
+{
+public:
+  static InputParameters validParams();
+
+  TemperatureArchiveWriter(const InputParameters & parameters);
+  virtual ~TemperatureArchiveWriter();
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+  virtual std::vector<std::string> statisticNames() const override;
+  virtual Real statistic(const std::string & name) const override;
+
+protected:
+  /// Wait for the previous frame to be written, reporting its write error if any
+  void waitForWrite();
+
+  /// Temperature to write
+  const VariableValue & _temperature;
+
+  /// Archive file
+  const std::string _file;
+
+  /// Whether this is the final execution, which only waits for the last frame
+  bool _final;
+
+  ///@{ Nodes and temperatures of this thread, joined into thread 0
+  std::vector<dof_id_type> _ids;
+  std::vector<Real> _values;
+  ///@}
+
+  /// Whether the nodes were gathered with the first frame
+  bool _setup;
+  /// Position of each node of this processor in the values it sends
+  std::unordered_map<dof_id_type, std::size_t> _local_slots;
+  /// Temperatures of this processor in the order it sends them
+  std::vector<Real> _local;
+  /// Position in the frames of each value gathered on the first processor
+  std::vector<std::size_t> _order;
+  /// Temperatures of the next frame
+  std::vector<Real> _frame;
+
+  /// Frame being written in the background
+  std::future<void> _pending;
+
+  /// Time the solve spent gathering the temperatures and waiting for the previous frame
+  CallTimer _timer;
+};
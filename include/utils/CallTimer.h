@@ -0,0 +1,60 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <chrono>
+
+/**
+ * Call count and cumulative wall time of a hot code path. Each thread-local
+ * object keeps its own timer, so no synchronisation is needed; the cost is
+ * two steady_clock reads per timed call.
+ */
+class CallTimer
+{
+public:
+  /// Times the enclosing scope as one call
+  class Scope
+  {
+  public:
+    Scope(CallTimer & timer) : _timer(timer), _start(std::chrono::steady_clock::now()) {}
+    ~Scope()
+    {
+      const std::chrono::duration<Real> elapsed = std::chrono::steady_clock::now() - _start;
+      _timer._seconds += elapsed.count();
+      ++_timer._calls;
+    }
+
+  private:
+    CallTimer & _timer;
+    const std::chrono::steady_clock::time_point _start;
+  };
+
+  void reset()
+  {
+    _calls = 0;
+    _seconds = 0.0;
+  }
+
+  /// Accumulate the calls of another timer, e.g. when joining threads
+  void add(const CallTimer & other)
+  {
+    _calls += other._calls;
+    _seconds += other._seconds;
+  }
+
+  unsigned long calls() const { return _calls; }
+  Real seconds() const { return _seconds; }
+
+private:
+  unsigned long _calls = 0;
+  Real _seconds = 0.0;
+};
@@ -0,0 +1,96 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstddef>
+
+/**
+ * Batched evaluation of the (weaving) diffused ellipsoid shape function
+ *
+ *   calc_va = sum_i exp(-((x + ox_i)^2 / rx^2 + (y + oy_i)^2 / ry^2 + (z + oz_i)^2 / rz^2))
+ *
+ * at a set of points given relative to the torch centre in the tilted frame.
+ * All point independent quantities are prepared once in a Shape, and the
+ * exponentials are vectorised with AVX-512 or AVX2. On x86-64 both paths are
+ * always compiled, whatever the flags of the build, and the widest one the CPU
+ * supports is chosen at run time, with a scalar std::exp fallback otherwise.
+ */
+namespace DiffusedEllipsoidKernel
+{
+/// Number of samples along one weave cycle
+constexpr unsigned int n_weave_samples = 13;
+
+/// Weave amplitudes below this value are treated as no weave
+constexpr Real weave_tolerance = 1e-6;
+
+/// Point independent part of the heat source shape
+struct Shape
+{
+  ///@{ Inverse squared ellipsoid radii
+  Real inv_rx2;
+  Real inv_ry2;
+  Real inv_rz2;
+  ///@}
+
+  /// Whether the torch weaves in each direction
+  bool weave[3];
+
+  /// Offsets of each weave sample, amplitude * sin(pi * i / 6)
+  Real offset[3][n_weave_samples];
+};
+
+/// Prepare the shape for the given radii and weave amplitudes
+Shape makeShape(Real rx, Real ry, Real rz, Real weave_x, Real weave_y, Real weave_z);
+
+/// Code paths of evaluate()
+enum class InstructionSet
+{
+  SCALAR,
+  AVX2,
+  AVX512
+};
+
+/// Whether this build and the CPU support an instruction set
+bool supported(InstructionSet set);
+
+/// Widest supported instruction set, used by evaluate()
+InstructionSet bestInstructionSet();
+
+/// Name of an instruction set
+const char * name(InstructionSet set);
+
+/// Name of the instruction set used by evaluate()
+const char * instructionSet();
+
+/**
+ * Evaluate calc_va at n points
+ * @param shape prepared heat source shape
+ * @param x,y,z coordinates relative to the torch centre in the tilted frame
+ * @param n number of points
+ * @param out calc_va at each point
+ */
+void evaluate(const Shape & shape,
+              const Real * x,
+              const Real * y,
+              const Real * z,
+              std::size_t n,
+              Real * out);
+
+/// Same as evaluate(), with the given supported instruction set
+void evaluate(InstructionSet set,
+              const Shape & shape,
+              const Real * x,
+              const Real * y,
+              const Real * z,
+              std::size_t n,
+              Real * out);
+}
@@ -0,0 +1,73 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+// No include guard: DiffusedEllipsoidKernel.C includes this once per instruction set, in a
+// namespace that defines the Simd type and with the instruction set enabled, so that the
+// functions below are compiled for it whatever the flags of the build.
+
+/// Evaluate Simd::width points, in the same order of operations as evaluatePoint()
+inline void
+evaluateBlock(const Shape & shape, const Real * x, const Real * y, const Real * z, Real * out)
+{
+  typedef Simd::V V;
+
+  const V vx = Simd::load(x);
+  const V vy = Simd::load(y);
+  const V vz = Simd::load(z);
+  const V irx2 = Simd::set(-shape.inv_rx2);
+  const V iry2 = Simd::set(-shape.inv_ry2);
+  const V irz2 = Simd::set(-shape.inv_rz2);
+
+  // Negated terms, so that the exponent is a plain sum
+  const V bx = Simd::mul(Simd::mul(vx, vx), irx2);
+  const V by = Simd::mul(Simd::mul(vy, vy), iry2);
+  const V bz = Simd::mul(Simd::mul(vz, vz), irz2);
+
+  if (!shape.weave[0] && !shape.weave[1] && !shape.weave[2])
+  {
+    Simd::store(out, Simd::exp(Simd::add(Simd::add(bx, by), bz)));
+    return;
+  }
+
+  V sum = Simd::set(0.0);
+  for (unsigned int i = 0; i < n_weave_samples; ++i)
+  {
+    if (shape.weave[0])
+    {
+      const V a = Simd::add(vx, Simd::set(shape.offset[0][i]));
+      const V e = Simd::add(Simd::add(Simd::mul(Simd::mul(a, a), irx2), by), bz);
+      sum = Simd::add(sum, Simd::exp(e));
+    }
+    if (shape.weave[1])
+    {
+      const V a = Simd::add(vy, Simd::set(shape.offset[1][i]));
+      const V e = Simd::add(Simd::add(bx, Simd::mul(Simd::mul(a, a), iry2)), bz);
+      sum = Simd::add(sum, Simd::exp(e));
+    }
+    if (shape.weave[2])
+    {
+      const V a = Simd::add(vz, Simd::set(shape.offset[2][i]));
+      const V e = Simd::add(Simd::add(bx, by), Simd::mul(Simd::mul(a, a), irz2));
+      sum = Simd::add(sum, Simd::exp(e));
+    }
+  }
+  Simd::store(out, sum);
+}
+
+/// Evaluate the whole blocks of Simd::width points among n
+/// @return the number of points evaluated
+std::size_t
+evaluateBlocks(
+    const Shape & shape, const Real * x, const Real * y, const Real * z, std::size_t n, Real * out)
+{
+  std::size_t p = 0;
+  for (; p + Simd::width <= n; p += Simd::width)
+    evaluateBlock(shape, x + p, y + p, z + p, out + p);
+  return p;
+}
@@ -0,0 +1,147 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "DiffusedEllipsoidKernel.h"
+#include "LinearInterpolation.h"
+#include "NEMLResetRule.h"
+#include "RankTwoTensor.h"
+
+#include <string>
+#include <vector>
+
+/// Piecewise linear temperature history of a material point
+class ThermalCycle
+{
+public:
+  ThermalCycle(const std::vector<Real> & times, const std::vector<Real> & temperatures);
+
+  /**
+   * Synthetic multi-pass weld cycle. Each pass heats from ambient to the peak
+   * temperature, holds it, cools back to ambient and dwells for the interpass
+   * time before the next pass.
+   */
+  static ThermalCycle weldPasses(Real ambient,
+                                 Real peak,
+                                 Real heating,
+                                 Real hold,
+                                 Real cooling,
+                                 Real interpass,
+                                 unsigned int passes);
+
+  /// Recorded cycle from a CSV file with time and temperature columns
+  static ThermalCycle fromCSV(const std::string & file);
+
+  /// Temperature at time t, constant before the first and after the last time
+  Real temperature(Real t) const { return _temperature.sample(t); }
+
+  ///@{ First and last time of the cycle
+  Real startTime() const { return _start; }
+  Real endTime() const { return _end; }
+  ///@}
+
+protected:
+  LinearInterpolation _temperature;
+  Real _start;
+  Real _end;
+};
+
+/**
+ * Mesh-free driver replaying a thermal cycle at many independent material
+ * points, for benchmarking the constitutive stack without a finite element
+ * problem. Consecutive points see the cycle delayed by a fixed time, as if a
+ * torch travelled past them. Each point is fully constrained, so its
+ * mechanical strain is minus the thermal strain.
+ *
+ * The mechanical update goes through NEMLBatchUpdate with points gathered and
+ * scattered in batches the size of an element by the same helpers as
+ * CauchyStressFromNEML, and the state is reset after each update with the
+ * NEMLResetRule of NEMLMaterialPropertyReset. The heat source benchmark evaluates
+ * DiffusedEllipsoidKernel over a cloud of points grouped the same way, as in
+ * FunctionPathDiffusedEllipsoidHeatSource.
+ *
+ * Points are split into contiguous blocks, one per thread, and each thread
+ * parses its own NEML model, mirroring NEMLModelCache. All storage is
+ * allocated before the time stepping loop starts.
+ */
+class MaterialPointDriver
+{
+public:
+  struct Options
+  {
+    /// Number of material points
+    std::size_t points = 1000;
+    /// Number of time steps over the cycle of the last point
+    unsigned int steps = 100;
+    /// Number of threads the points are split over
+    unsigned int threads = 1;
+    /// Points updated together, like the quadrature points of an element
+    std::size_t batch_size = 8;
+    /// Delay of the thermal cycle between consecutive points
+    Real delay = 0.0;
+    /// Coefficient of thermal expansion
+    Real thermal_expansion = 1.2e-5;
+  };
+
+  struct Result
+  {
+    /// Point updates, or heat source evaluations
+    unsigned long updates = 0;
+    ///@{ Point updates followed by a state reset or by holding the state constant
+    unsigned long resets = 0;
+    unsigned long consts = 0;
+    ///@}
+    /// Wall time of the time stepping loops, excluding the setup
+    Real seconds = 0.0;
+    /// Final stress of each point
+    std::vector<RankTwoTensor> stress;
+    /// Sum of the heat source shape function values
+    Real checksum = 0.0;
+
+    Real updatesPerSecond() const { return seconds > 0.0 ? updates / seconds : 0.0; }
+  };
+
+  /**
+   * @param xml NEML XML database text
+   * @param model model name in the database
+   * @param cycle thermal cycle replayed at each point
+   */
+  MaterialPointDriver(const std::string & xml,
+                      const std::string & model,
+                      const ThermalCycle & cycle);
+
+  /// Apply the reset rule to the given NEML internal variables after each update
+  void setReset(const NEMLResetRule & rule, const std::vector<std::string> & variables);
+
+  /// Replay the cycle at all points
+  Result run(const Options & options) const;
+
+  /**
+   * Evaluate the heat source shape at a cloud of points while the torch
+   * travels along x through the cloud
+   */
+  static Result runHeatSource(const DiffusedEllipsoidKernel::Shape & shape,
+                              const Options & options);
+
+protected:
+  /// Replay the cycle at points [begin, end) on the calling thread
+  void
+  runPoints(std::size_t begin, std::size_t end, const Options & options, Result & result) const;
+
+  const std::string _xml;
+  const std::string _model;
+  const ThermalCycle _cycle;
+
+  ///@{ Optional state reset
+  bool _reset;
+  NEMLResetRule _rule;
+  std::vector<std::string> _reset_variables;
+  ///@}
+};
@@ -0,0 +1,211 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "RankTwoTensor.h"
+#include "CallTimer.h"
+
+#include "neml_interface.h"
+
+#include <string>
+#include <vector>
+
+class InputParameters;
+
+/**
+ * Packed inputs and outputs of NEML updates for a batch of material points,
+ * e.g. all quadrature points of an element. Tensors are stored point after
+ * point in Mandel notation (6 entries per symmetric tensor, 3 per skew
+ * tensor, 36 and 18 per tangent), so that the conversions from and to MOOSE
+ * tensors run as flat loops over the whole batch, and the model is called
+ * back to back for all points.
+ */
+struct NEMLBatchUpdate
+{
+  /// Parameters shared by the materials that update through a batch, added with params +=
+  static InputParameters validParams();
+
+  /// Size the packed arrays for n points
+  void resize(std::size_t n);
+
+  /// Number of points in the batch
+  std::size_t size() const { return T_np1.size(); }
+
+  /**
+   * Update all points of the batch
+   * @param model NEML model to call
+   * @param large_kinematics call update_ld_inc instead of update_sd
+   * @param t_np1,t_n current and previous time
+   * A point whose update fails is retried in sub-increments when substepping
+   * is enabled. Throws neml::NEMLError if the update fails at any point and
+   * substepping cannot recover it. Points flagged in predict are updated with
+   * the elastic predictor instead, which requires small kinematics.
+   */
+  void update(neml::NEMLModel & model, bool large_kinematics, double t_np1, double t_n);
+
+  /**
+   * Pack the tensors of all points of the batch, one tensor per point in each array
+   * @param stress_old stress at the start of the increment
+   * @param strain,strain_old mechanical strain at the end and start of the increment
+   * @param rotation,rotation_old rotation at the end and start of the increment
+   */
+  void gatherTensors(const RankTwoTensor * stress_old,
+                     const RankTwoTensor * strain,
+                     const RankTwoTensor * strain_old,
+                     const RankTwoTensor * rotation,
+                     const RankTwoTensor * rotation_old);
+
+  /// Set the scalar inputs and the history storage of point i, with null histories for models
+  /// without internal variables
+  void gatherPoint(std::size_t i,
+                   double temperature,
+                   double temperature_old,
+                   double * history,
+                   const double * history_old,
+                   double energy_old,
+                   double dissipation_old);
+
+  /// Copy the stress, energy and dissipation of point i out of the batch
+  void
+  scatterPoint(std::size_t i, RankTwoTensor & stress, double & energy, double & dissipation) const;
+
+  /// Zero the statistics
+  void resetStatistics();
+
+  /// Names of the statistics reported by the materials that update through a batch
+  static std::vector<std::string> statisticNames();
+
+  /// One of statisticNames(), with the calls and time of the material from its timer
+  Real statistic(const std::string & name, const CallTimer & timer) const;
+
+  /// The linear elastic model of a small strain NEML model, nullptr for other models
+  static const neml::LinearElasticModel * elasticModel(const neml::NEMLModel & model);
+
+  /// The model as a NEML model that can check its flow surface on a trial state, nullptr for
+  /// models without one
+  static neml::SubstepModel_sd * yieldModel(neml::NEMLModel & model);
+
+  /// Set the elastic and yield models of the elastic predictor from the model, false if the
+  /// model has either of them missing
+  bool setupPredictor(neml::NEMLModel & model);
+
+  /// Pack n symmetric tensors into Mandel notation
+  static void packSymmetric(const RankTwoTensor * in, std::size_t n, double * out);
+
+  /// Pack the skew parts of n tensors
+  static void packSkew(const RankTwoTensor * in, std::size_t n, double * out);
+
+  /// Unpack n symmetric tensors from Mandel notation
+  static void unpackSymmetric(const double * in, std::size_t n, RankTwoTensor * out);
+
+  ///@{ Inputs
+  std::vector<double> e_np1;
+  std::vector<double> e_n;
+  std::vector<double> w_np1;
+  std::vector<double> w_n;
+  std::vector<double> s_n;
+  std::vector<double> T_np1;
+  std::vector<double> T_n;
+  std::vector<double> u_n;
+  std::vector<double> p_n;
+  /// History is updated in place in the material property storage
+  std::vector<double *> h_np1;
+  std::vector<const double *> h_n;
+  /// Points to update with the elastic predictor rather than the full model (empty for none)
+  std::vector<char> predict;
+  ///@}
+
+  ///@{ Outputs
+  std::vector<double> s_np1;
+  std::vector<double> A_np1;
+  std::vector<double> B_np1;
+  std::vector<double> u_np1;
+  std::vector<double> p_np1;
+  std::vector<double> estrain;
+  /// Whether the update of each point was elastic, i.e. did not dissipate
+  std::vector<char> elastic;
+  ///@}
+
+  ///@{ Substepping of failed updates: the smallest sub-increment is 2^-max_substep_depth of the
+  /// increment (0 disables substepping), and each accepted sub-increment grows the next one by
+  /// substep_growth. The tangent of a substepped point is that of its last sub-increment only,
+  /// as NEML does not provide the derivatives with respect to the start state needed to chain
+  /// the sub-increment tangents.
+  unsigned int max_substep_depth = 0;
+  double substep_growth = 2.0;
+  ///@}
+
+  ///@{ Tangents the material converted and skipped, and failed updates, since the last
+  /// resetStatistics()
+  unsigned long tangents_computed = 0;
+  unsigned long tangents_skipped = 0;
+  unsigned long failures = 0;
+  ///@}
+
+  ///@{ Substepping statistics since the last resetStatistics()
+  unsigned long substepped_points = 0;
+  unsigned long substeps = 0;
+  unsigned int deepest_substep = 0;
+  ///@}
+
+  ///@{ Elastic model used by the elastic predictor and the model checking that predicted
+  /// increments stay elastic, see elasticModel() and yieldModel()
+  const neml::LinearElasticModel * elastic_model = nullptr;
+  neml::SubstepModel_sd * yield_model = nullptr;
+  ///@}
+
+  ///@{ Points updated with the elastic predictor and with the full model since the last
+  /// resetStatistics()
+  unsigned long predicted_points = 0;
+  unsigned long updated_points = 0;
+  ///@}
+
+protected:
+  /// Update point i over the fraction [f0, f1] of the increment, starting from the given state
+  void step(neml::NEMLModel & model,
+            bool large_kinematics,
+            double t_np1,
+            double t_n,
+            std::size_t i,
+            double f0,
+            double f1,
+            const double * s_start,
+            const double * h_start,
+            double u_start,
+            double p_start);
+
+  /**
+   * Update point i as purely elastic if the trial state is inside the flow surface of the
+   * model: the stress is the elastic stiffness at the new temperature times the old elastic
+   * strain plus the strain increment, the history is carried over and the stiffness is the
+   * tangent. Thermal strain increments are neglected.
+   * @return false, leaving the point to the full update, if the increment is not elastic
+   */
+  bool predictElastic(
+      neml::NEMLModel & model, double t_np1, double t_n, std::size_t i, std::size_t nstore);
+
+  /// Recover a failed update of point i with adaptive sub-increments
+  void
+  substep(neml::NEMLModel & model, bool large_kinematics, double t_np1, double t_n, std::size_t i);
+
+  /// History at the start of the current sub-increment
+  std::vector<double> _h_sub;
+
+  ///@{ Elastic stiffness last evaluated by the predictor and its temperature
+  double _C[36];
+  double _C_T = 0.0;
+  bool _C_valid = false;
+  ///@}
+};
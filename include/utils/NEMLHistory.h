@@ -0,0 +1,143 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "DataIO.h"
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+/**
+ * Pool of NEML history slots. All histories of the same length, which is the
+ * nstore() of their model, share slabs of slots of exactly that length, so the
+ * quadrature points of a block are packed without per-point heap allocations
+ * or allocator headers. Released slots are reused by the next history of the
+ * same length, so copies and re-initialisation stop allocating once the pool
+ * has grown to the size of the problem. Slabs are kept until the process ends.
+ */
+namespace NEMLHistoryPool
+{
+/// A slot of n entries (nullptr for n = 0)
+Real * acquire(std::size_t n);
+
+/// Return a slot of n entries obtained from acquire()
+void release(Real * slot, std::size_t n);
+
+/// Number of slots of n entries currently handed out
+std::size_t slotsInUse(std::size_t n);
+}
+
+/**
+ * NEML history of one quadrature point: a slot of exactly the model's nstore()
+ * entries from NEMLHistoryPool. The object itself is a pointer and a size. It
+ * is stored and loaded in the same layout as std::vector<Real>, so restart
+ * data written with the std::vector<Real> history property reads back.
+ */
+class NEMLHistory
+{
+public:
+  NEMLHistory() : _data(nullptr), _size(0) {}
+
+  NEMLHistory(const NEMLHistory & other) : _data(nullptr), _size(0) { *this = other; }
+
+  NEMLHistory(NEMLHistory && other) noexcept : _data(other._data), _size(other._size)
+  {
+    other._data = nullptr;
+    other._size = 0;
+  }
+
+  ~NEMLHistory() { NEMLHistoryPool::release(_data, _size); }
+
+  NEMLHistory & operator=(const NEMLHistory & other)
+  {
+    if (this != &other)
+    {
+      resize(other._size);
+      std::copy(other.begin(), other.end(), begin());
+    }
+    return *this;
+  }
+
+  NEMLHistory & operator=(NEMLHistory && other) noexcept
+  {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    return *this;
+  }
+
+  /// Resize, keeping the leading entries (new entries are not initialized)
+  void resize(std::size_t n)
+  {
+    if (n == _size)
+      return;
+
+    Real * data = NEMLHistoryPool::acquire(n);
+    std::copy(begin(), begin() + std::min<std::size_t>(n, _size), data);
+    NEMLHistoryPool::release(_data, _size);
+    _data = data;
+    _size = n;
+  }
+
+  std::size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  Real * data() { return _data; }
+  const Real * data() const { return _data; }
+
+  Real & operator[](std::size_t i) { return _data[i]; }
+  const Real & operator[](std::size_t i) const { return _data[i]; }
+
+  Real * begin() { return _data; }
+  Real * end() { return _data + _size; }
+  const Real * begin() const { return _data; }
+  const Real * end() const { return _data + _size; }
+
+private:
+  Real * _data;
+  unsigned int _size;
+};
+
+inline std::ostream &
+operator<<(std::ostream & os, const NEMLHistory & history)
+{
+  os << '[';
+  for (std::size_t i = 0; i < history.size(); ++i)
+    os << (i ? ", " : "") << history[i];
+  return os << ']';
+}
+
+template <>
+inline void
+dataStore(std::ostream & stream, NEMLHistory & history, void * context)
+{
+  // Same layout as std::vector<Real>
+  unsigned int size = history.size();
+  dataStore(stream, size, context);
+  for (auto & value : history)
+    dataStore(stream, value, context);
+}
+
+template <>
+inline void
+dataLoad(std::istream & stream, NEMLHistory & history, void * context)
+{
+  unsigned int size;
+  dataLoad(stream, size, context);
+  history.resize(size);
+  for (auto & value : history)
+    dataLoad(stream, value, context);
+}
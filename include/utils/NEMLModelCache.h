@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "neml_interface.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Process-wide registry of NEML models. A model is identified by its XML
+ * database, its name in the database and the values substituted for any
+ * {variables} in the XML text. Each database is read once, and each model is
+ * parsed once per thread, so that all materials, aux kernels and user objects
+ * on a thread share one instance. NEML models do not keep per-point state, but
+ * they are not guaranteed to be reentrant, hence one instance per thread.
+ */
+namespace NEMLModelCache
+{
+/// Substituted {variable} names and values
+typedef std::vector<std::pair<std::string, Real>> Variables;
+
+/**
+ * Model from an XML database
+ * @param file path to the XML database
+ * @param name model name in the database
+ * @param tid thread the model will be used on
+ */
+std::shared_ptr<neml::NEMLModel>
+model(const std::string & file, const std::string & name, THREAD_ID tid);
+
+/**
+ * Model from an XML database after substituting {variable} values
+ * @param file path to the XML database
+ * @param name model name in the database
+ * @param variables the substituted names and values, part of the cache key
+ * @param xml the XML text after substitution
+ * @param tid thread the model will be used on
+ */
+std::shared_ptr<neml::NEMLModel> model(const std::string & file,
+                                       const std::string & name,
+                                       const Variables & variables,
+                                       const std::string & xml,
+                                       THREAD_ID tid);
+
+/// Number of models parsed by this process so far
+std::size_t parseCount();
+}
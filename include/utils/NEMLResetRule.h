@@ -0,0 +1,71 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * Single- or two-stage NEML state reset triggered by a coupled value, typically
+ * the temperature. A single-stage reset restores the initial state at or above
+ * the critical value. A two-stage reset restores it at or above the upper value
+ * and holds the state constant between the lower and upper values.
+ */
+struct NEMLResetRule
+{
+  enum class Action
+  {
+    NONE,
+    CONST,
+    RESET
+  };
+
+  /// What to do with the state at a point with the given value
+  Action action(Real value) const
+  {
+    if (!two_stage)
+      return value >= critical_value ? Action::RESET : Action::NONE;
+    if (value >= upper_value)
+      return Action::RESET;
+    if (value >= lower_value)
+      return Action::CONST;
+    return Action::NONE;
+  }
+
+  /// Values below this never trigger an action
+  Real activityThreshold() const { return two_stage ? lower_value : critical_value; }
+
+  /**
+   * Apply an action to some internal variables of a NEML history
+   * @param indices offsets of the variables in the history
+   * @param initial initial history, restored by a reset
+   * @param old history at the start of the step, held by a constant action
+   * @param history history to modify
+   */
+  static void apply(Action action,
+                    const std::vector<unsigned int> & indices,
+                    const Real * initial,
+                    const Real * old,
+                    Real * history)
+  {
+    if (action == Action::RESET)
+      for (auto i : indices)
+        history[i] = initial[i];
+    else if (action == Action::CONST)
+      for (auto i : indices)
+        history[i] = old[i];
+  }
+
+  bool two_stage = false;
+  Real critical_value = 0.0;
+  Real lower_value = 0.0;
+  Real upper_value = 0.0;
+};
@@ -0,0 +1,183 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "NEMLHistory.h"
+#include "RankTwoTensor.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Compact archive of the NEML material state of CauchyStressFromNEML, written
+ * by NEMLStateCheckpoint. Each processor appends frames to its own file. A
+ * frame holds the records of the elements whose state changed since the
+ * previous frame, so the state of an element is its record in the latest
+ * frame that contains it. A frame is a table of the element id and number of
+ * quadrature points of each record, followed by the packed doubles of all
+ * records: for each quadrature point the history, energy, dissipation, the six
+ * stress components and the three components of the linear rotation. The
+ * values of a frame may be compressed with zlib, the table never is.
+ *
+ * Reading maps the files into memory and indexes the latest record of each
+ * element from the tables alone. Uncompressed values are read in place, and
+ * only the compressed frames that still hold the latest record of some element
+ * are decompressed. An element that moved between processors takes its record
+ * from the file with the latest step.
+ */
+class NEMLStateArchive
+{
+public:
+  /// Fixed size header in front of the records of each frame
+  struct FrameHeader
+  {
+    char magic[8];
+    std::uint64_t step;
+    double time;
+    std::uint32_t nstore;
+    std::uint32_t flags;
+    std::uint64_t records;
+    /// Size of the values before and after compression, without padding
+    std::uint64_t raw_bytes;
+    std::uint64_t stored_bytes;
+  };
+
+  /// Flag of frames with zlib compressed records
+  static constexpr std::uint32_t compressed_flag = 1;
+
+  /// Packed values per quadrature point besides the history
+  static constexpr std::size_t extra_values = 11;
+
+  /// Packed values per quadrature point
+  static std::size_t valuesPerQp(std::size_t nstore) { return nstore + extra_values; }
+
+  /// Archive file of a processor
+  static std::string
+  fileName(const std::string & file_base, processor_id_type rank, processor_id_type n_procs);
+
+  ///@{ Pack and unpack the state of one quadrature point
+  static void packQp(const NEMLHistory & history,
+                     Real energy,
+                     Real dissipation,
+                     const RankTwoTensor & stress,
+                     const RankTwoTensor & rotation,
+                     double * out);
+  static void unpackQp(const double * in,
+                       NEMLHistory & history,
+                       Real & energy,
+                       Real & dissipation,
+                       RankTwoTensor & stress,
+                       RankTwoTensor & rotation);
+  ///@}
+
+  /**
+   * Append a frame to a file
+   * @param file archive file
+   * @param header frame header, the sizes and flags are filled in
+   * @param records packed records, each the element id and number of quadrature points as two
+   * std::uint64_t followed by the packed values
+   * @param compress compress the values with zlib
+   */
+  static void appendFrame(const std::string & file,
+                          FrameHeader header,
+                          const std::vector<char> & records,
+                          bool compress);
+
+  /**
+   * Cut an archive file back to the complete frames up to a time step, e.g. when a run is
+   * recovered, so that frames of the interrupted run after that step or cut short by it do not
+   * follow the frames appended by the recovered run. The kept frames are written to a new file
+   * that replaces the archive, as readers may have the old one mapped.
+   */
+  static void truncate(const std::string & file, std::uint64_t max_step);
+
+  /**
+   * Open the archives written by all processors under a file base
+   * @param file_base file base given to NEMLStateCheckpoint
+   * @param max_step ignore frames written after this time step
+   */
+  NEMLStateArchive(const std::string & file_base, std::uint64_t max_step);
+  ~NEMLStateArchive();
+
+  /**
+   * Archive shared by all callers with the same arguments, opened by the first one and closed
+   * when the last one releases it, so that the files are mapped and indexed once per process
+   */
+  static std::shared_ptr<const NEMLStateArchive> shared(const std::string & file_base,
+                                                        std::uint64_t max_step);
+
+  NEMLStateArchive(const NEMLStateArchive &) = delete;
+  NEMLStateArchive & operator=(const NEMLStateArchive &) = delete;
+
+  /// Number of history variables per quadrature point
+  std::size_t nstore() const { return _nstore; }
+
+  /// Number of elements in the archive
+  std::size_t size() const { return _elements.size(); }
+
+  /// Number of compressed frames that had to be decompressed
+  std::size_t inflatedFrames() const { return _inflated.size(); }
+
+  /**
+   * Packed state of the quadrature points of an element
+   * @param id element id
+   * @param nqp expected number of quadrature points
+   * @return the values, or nullptr if the element is not in the archive
+   */
+  const double * element(dof_id_type id, unsigned int nqp) const;
+
+protected:
+  /// Map a file and index its frames
+  void read(const std::string & file, std::uint64_t max_step);
+
+  /// Index the records of one frame from its table
+  void index(const std::uint64_t * table, const FrameHeader & header, std::size_t frame);
+
+  /// Point the records at their values, decompressing the frames that hold any of them
+  void resolve();
+
+  struct Frame
+  {
+    FrameHeader header;
+    /// Stored values in the mapped file
+    const char * stored;
+    /// Values, in place or decompressed, once resolved
+    const double * values;
+  };
+
+  struct Record
+  {
+    std::uint64_t step;
+    unsigned int nqp;
+    /// Frame and offset of the values in it
+    std::size_t frame;
+    std::uint64_t offset;
+    const double * values;
+  };
+
+  /// Latest record of each element, over the files of all processors
+  std::unordered_map<dof_id_type, Record> _elements;
+
+  /// Number of history variables, the same in all frames
+  std::size_t _nstore;
+
+  /// Frames up to the requested step
+  std::vector<Frame> _frames;
+
+  /// Memory mapped files
+  std::vector<std::pair<void *, std::size_t>> _maps;
+
+  /// Decompressed records, 8 byte aligned
+  std::vector<std::vector<double>> _inflated;
+};
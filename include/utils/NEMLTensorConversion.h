@@ -0,0 +1,121 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/*                       BlackBear                              */
+/*                                                              */
+/*           (c) 2017 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#pragma once
+
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+/**
+ * Conversions between MOOSE tensors and the Mandel notation used by NEML.
+ * Index and scaling tables are built at compile time and the results are
+ * written straight into the tensor storage, so none of these allocate.
+ */
+namespace NEMLTensorConversion
+{
+// NEML writes through raw double pointers into the tensor storage
+static_assert(std::is_same<Real, double>::value,
+              "MOOSE/libMesh must be compiled with double precision Real types");
+
+namespace detail
+{
+/// Tensor indices of the Mandel components
+constexpr unsigned int mandel_i[6] = {0, 1, 2, 1, 0, 0};
+constexpr unsigned int mandel_j[6] = {0, 1, 2, 2, 2, 1};
+
+/// Scaling from tensor to Mandel components and back
+constexpr Real mandel_mult[6] = {1.0, 1.0, 1.0, M_SQRT2, M_SQRT2, M_SQRT2};
+constexpr Real mandel_inv_mult[6] = {1.0, 1.0, 1.0, M_SQRT1_2, M_SQRT1_2, M_SQRT1_2};
+
+/// Mandel component holding tensor entry (i, j)
+constexpr unsigned int
+mandelIndex(unsigned int i, unsigned int j)
+{
+  return i == j ? i : 6 - i - j;
+}
+
+/// Source entry in a 6x6 Mandel matrix and scaling for each of the 81 fourth order entries
+struct FourthEntry
+{
+  unsigned int source;
+  Real mult;
+};
+
+constexpr std::array<FourthEntry, 81>
+makeFourthTable()
+{
+  std::array<FourthEntry, 81> table{};
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      for (unsigned int k = 0; k < 3; ++k)
+        for (unsigned int l = 0; l < 3; ++l)
+        {
+          const auto a = mandelIndex(i, j);
+          const auto b = mandelIndex(k, l);
+          table[((i * 3 + j) * 3 + k) * 3 + l] = {a * 6 + b,
+                                                  mandel_inv_mult[a] * mandel_inv_mult[b]};
+        }
+  return table;
+}
+
+constexpr std::array<FourthEntry, 81> fourth_table = makeFourthTable();
+}
+
+/// Symmetric second order tensor to Mandel notation
+inline void
+rankTwoToMandel(const RankTwoTensor & in, double * const out)
+{
+  for (unsigned int a = 0; a < 6; ++a)
+    out[a] = in(detail::mandel_i[a], detail::mandel_j[a]) * detail::mandel_mult[a];
+}
+
+/// Mandel notation to a symmetric second order tensor
+inline void
+mandelToRankTwo(const double * const in, RankTwoTensor & out)
+{
+  for (unsigned int a = 0; a < 6; ++a)
+  {
+    const Real v = in[a] * detail::mandel_inv_mult[a];
+    out(detail::mandel_i[a], detail::mandel_j[a]) = v;
+    out(detail::mandel_j[a], detail::mandel_i[a]) = v;
+  }
+}
+
+/// Skew part of a second order tensor to NEML's three component vector
+inline void
+rankTwoToSkew(const RankTwoTensor & in, double * const out)
+{
+  out[0] = -in(1, 2);
+  out[1] = in(0, 2);
+  out[2] = -in(0, 1);
+}
+
+/// 6x6 Mandel matrix to a fourth order tensor with minor symmetries
+inline void
+mandelToRankFour(const double * const in, RankFourTensor & out)
+{
+  Real * const vals = &out(0, 0, 0, 0);
+  for (unsigned int n = 0; n < 81; ++n)
+    vals[n] = in[detail::fourth_table[n].source] * detail::fourth_table[n].mult;
+}
+
+#ifdef NEML_ENABLED
+/// Symmetric (6x6) and skew (6x3) NEML tangent parts to the full fourth order tangent
+void recombineTangent(const double * const Dpart, const double * const Wpart, RankFourTensor & out);
+#endif
+}
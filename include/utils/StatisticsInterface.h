@@ -0,0 +1,31 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Interface for objects that keep named, thread-local counters which can be
+ * reported by the ObjectStatistic postprocessor.
+ */
+class StatisticsInterface
+{
+public:
+  virtual ~StatisticsInterface() = default;
+
+  /// Names of the statistics reported by this object
+  virtual std::vector<std::string> statisticNames() const = 0;
+
+  /// Value of a statistic accumulated by this (thread-local) object
+  virtual Real statistic(const std::string & name) const = 0;
+};
@@ -0,0 +1,137 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * Time-indexed archive of nodal temperatures, written by
+ * TemperatureArchiveWriter and read by TemperatureArchiveReader. The file
+ * holds a header with the number of nodes and their sorted ids, followed by
+ * one fixed size frame per time step: the time, the step and the temperature
+ * of each node in id order. Frames have increasing times.
+ *
+ * The file is memory mapped for reading. As frames have a fixed size, a
+ * frame is found by its offset, and a reader can follow a file that is still
+ * being written by mapping it again once it has grown or has been replaced by
+ * a recovered writer. A frame is only visible once it has been written
+ * completely.
+ */
+class TemperatureArchive
+{
+public:
+  struct FileHeader
+  {
+    char magic[8];
+    std::uint64_t nodes;
+  };
+
+  struct FrameHeader
+  {
+    double time;
+    std::uint64_t step;
+  };
+
+  /// Slot of nodes that are not in the archive
+  static constexpr std::size_t invalid_slot = std::numeric_limits<std::size_t>::max();
+
+  /// Start a new archive for the given sorted node ids, replacing any existing file
+  static void create(const std::string & file, const std::vector<dof_id_type> & node_ids);
+
+  /// Append the temperatures of all nodes, in the order of the node ids
+  static void appendFrame(const std::string & file,
+                          const FrameHeader & header,
+                          const std::vector<Real> & values);
+
+  /**
+   * Drop the frames at or after a time, so that a recovered run can append to
+   * its archive again. The frames that are kept are copied to a new file that
+   * replaces the archive, as readers may have the old one mapped.
+   * @return the number of nodes in the archive, 0 if there is no archive
+   */
+  static std::size_t truncate(const std::string & file, Real time);
+
+  /// Map an archive, nothing is mapped if the file does not exist yet
+  TemperatureArchive(const std::string & file);
+  ~TemperatureArchive();
+
+  TemperatureArchive(const TemperatureArchive &) = delete;
+  TemperatureArchive & operator=(const TemperatureArchive &) = delete;
+
+  /**
+   * Map the frames appended since the last call
+   * @return whether there are new frames, or the file was replaced
+   */
+  bool refresh();
+
+  /**
+   * Refresh until there is a frame at or after a time, waiting for the writer
+   * @param t time to wait for
+   * @param timeout longest time to wait in seconds
+   * @param waited time spent waiting in seconds
+   * @return whether the frame is there
+   */
+  bool waitFor(Real t, Real timeout, Real & waited);
+
+  /// Number of nodes in each frame
+  std::size_t nodes() const { return _nodes; }
+
+  /// Number of complete frames
+  std::size_t frames() const { return _frames; }
+
+  /// Time of a frame
+  Real time(std::size_t frame) const { return header(frame).time; }
+
+  /// First frame with a time not before t, frames() if there is none
+  std::size_t lowerBound(Real t) const;
+
+  /// Temperatures of a frame, in the order of the node ids
+  const Real * values(std::size_t frame) const
+  {
+    return reinterpret_cast<const Real *>(frameData(frame) + sizeof(FrameHeader));
+  }
+
+  /// Position of a node in the frames, invalid_slot if it is not in the archive
+  std::size_t slot(dof_id_type id) const;
+
+  /// Ask the operating system to read frames [first, last) ahead of their use
+  void prefetch(std::size_t first, std::size_t last) const;
+
+protected:
+  /// Size of the file header and node ids
+  std::size_t dataOffset() const;
+  std::size_t frameBytes() const;
+
+  const char * frameData(std::size_t frame) const
+  {
+    return static_cast<const char *>(_map) + dataOffset() + frame * frameBytes();
+  }
+  FrameHeader header(std::size_t frame) const;
+
+  const std::string _file;
+
+  /// Mapped part of the file
+  void * _map;
+  std::size_t _mapped;
+  ///@{ Mapped file, which a recovered writer may replace
+  std::uint64_t _device;
+  std::uint64_t _inode;
+  ///@}
+
+  std::size_t _nodes;
+  std::size_t _frames;
+  /// Sorted node ids, in the mapped file
+  const std::uint64_t * _ids;
+};
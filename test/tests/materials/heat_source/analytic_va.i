@@ -0,0 +1,98 @@
+# The torch starts inside the mesh, where va is the closed form integral of
+# the ellipsoid, and ends on the mesh boundary, where va is the integral of
+# calc_va over the clipped region. Either way va must match the integral of
+# calc_va over the mesh.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 32
+  ny = 12
+  nz = 12
+  xmax = 8
+  ymax = 3
+  zmax = 3
+[]
+
+[Variables]
+  [T]
+    initial_condition = 300
+  []
+[]
+
+[Kernels]
+  [time]
+    type = ADHeatConductionTimeDerivative
+    variable = T
+  []
+  [conduction]
+    type = ADHeatConduction
+    variable = T
+  []
+  [source]
+    type = ADMatHeatSource
+    variable = T
+    material_property = volumetric_heat
+  []
+[]
+
+[Functions]
+  [torch_x]
+    type = ParsedFunction
+    expression = '2 + 1.5 * t'
+  []
+[]
+
+[Materials]
+  [thermal]
+    type = ADGenericConstantMaterial
+    prop_names = 'thermal_conductivity specific_heat density'
+    prop_values = '10 1 1'
+  []
+  [heat_source]
+    type = FunctionPathDiffusedEllipsoidHeatSource
+    function_path_x = torch_x
+    path_y = 1.5
+    path_z = 1.5
+    rx = 0.5
+    ry = 0.5
+    rz = 0.5
+    power = 100
+    analytic_va = true
+    cull_elements = true
+    cull_cutoff = 3
+  []
+[]
+
+[Postprocessors]
+  [va]
+    type = ObjectStatistic
+    material = heat_source
+    statistic = va
+    reduction = max
+  []
+  [integral]
+    type = ADElementIntegralMaterialProperty
+    mat_prop = calc_va
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'abs(va - integral) > 0.02 * integral'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
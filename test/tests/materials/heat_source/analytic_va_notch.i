@@ -0,0 +1,111 @@
+# The mesh has a notch next to the torch path, inside its bounding box, so the
+# bounding box alone cannot tell whether the torch is clipped. va must still
+# match the integral of calc_va over the mesh.
+
+[Mesh]
+  [box]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 32
+    ny = 12
+    nz = 12
+    xmax = 8
+    ymax = 3
+    zmax = 3
+  []
+  [notch_block]
+    type = SubdomainBoundingBoxGenerator
+    input = box
+    block_id = 1
+    bottom_left = '3 2 0'
+    top_right = '5 3 3'
+  []
+  [notch]
+    type = BlockDeletionGenerator
+    input = notch_block
+    block = 1
+  []
+[]
+
+[Variables]
+  [T]
+    initial_condition = 300
+  []
+[]
+
+[Kernels]
+  [time]
+    type = ADHeatConductionTimeDerivative
+    variable = T
+  []
+  [conduction]
+    type = ADHeatConduction
+    variable = T
+  []
+  [source]
+    type = ADMatHeatSource
+    variable = T
+    material_property = volumetric_heat
+  []
+[]
+
+[Functions]
+  [torch_x]
+    type = ParsedFunction
+    expression = '2 + t'
+  []
+[]
+
+[Materials]
+  [thermal]
+    type = ADGenericConstantMaterial
+    prop_names = 'thermal_conductivity specific_heat density'
+    prop_values = '10 1 1'
+  []
+  [heat_source]
+    type = FunctionPathDiffusedEllipsoidHeatSource
+    function_path_x = torch_x
+    path_y = 1.5
+    path_z = 1.5
+    rx = 0.5
+    ry = 0.5
+    rz = 0.5
+    power = 100
+    analytic_va = true
+    cull_elements = true
+    cull_cutoff = 3
+  []
+[]
+
+[Postprocessors]
+  [va]
+    type = ObjectStatistic
+    material = heat_source
+    statistic = va
+    reduction = max
+  []
+  [integral]
+    type = ADElementIntegralMaterialProperty
+    mat_prop = calc_va
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'abs(va - integral) > 0.02 * integral'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,104 @@
+# A torch moving along a long bead. Elements away from the torch are culled,
+# and the run fails if nothing is culled or if the largest calc_va measured at
+# a culled quadrature point exceeds the cutoff bound exp(-cull_cutoff^2).
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 4
+  nz = 4
+  xmax = 20
+  ymax = 1
+  zmax = 1
+[]
+
+[Variables]
+  [T]
+    initial_condition = 300
+  []
+[]
+
+[Kernels]
+  [time]
+    type = ADHeatConductionTimeDerivative
+    variable = T
+  []
+  [conduction]
+    type = ADHeatConduction
+    variable = T
+  []
+  [source]
+    type = ADMatHeatSource
+    variable = T
+    material_property = volumetric_heat
+  []
+[]
+
+[Functions]
+  [torch_x]
+    type = ParsedFunction
+    expression = '2 + 3 * t'
+  []
+[]
+
+[Materials]
+  [thermal]
+    type = ADGenericConstantMaterial
+    prop_names = 'thermal_conductivity specific_heat density'
+    prop_values = '10 1 1'
+  []
+  [heat_source]
+    type = FunctionPathDiffusedEllipsoidHeatSource
+    function_path_x = torch_x
+    path_y = 0.5
+    path_z = 1
+    rx = 0.5
+    ry = 0.5
+    rz = 0.3
+    power = 100
+    va = 0.37
+    cull_elements = true
+    cull_cutoff = 4
+    check_culling = true
+  []
+[]
+
+[Postprocessors]
+  [culled]
+    type = ObjectStatistic
+    material = heat_source
+    statistic = culled_evaluations
+  []
+  [evaluated]
+    type = ObjectStatistic
+    material = heat_source
+    statistic = full_evaluations
+  []
+  [neglected]
+    type = ObjectStatistic
+    material = heat_source
+    statistic = culled_calc_va
+    reduction = max
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'culled < 1 | evaluated < 1 | neglected <= 0 | neglected > exp(-16)'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
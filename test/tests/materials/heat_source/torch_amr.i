@@ -0,0 +1,153 @@
+# A torch moving along a long bead with the mesh refined around it and
+# coarsened behind it. The run fails if the elements under the torch are not
+# refined to the maximum level, or if the number of active elements grows
+# beyond a fraction of the uniformly refined mesh (10240 elements) as the torch
+# moves. The 8 torch positions sampled over the 3 long window are less than an
+# ellipsoid radius apart.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 2
+  nz = 2
+  xmax = 40
+  ymax = 1
+  zmax = 1
+[]
+
+[Variables]
+  [T]
+    initial_condition = 300
+  []
+[]
+
+[Kernels]
+  [time]
+    type = ADHeatConductionTimeDerivative
+    variable = T
+  []
+  [conduction]
+    type = ADHeatConduction
+    variable = T
+  []
+  [source]
+    type = ADMatHeatSource
+    variable = T
+    material_property = volumetric_heat
+  []
+[]
+
+[Functions]
+  [torch_x]
+    type = ParsedFunction
+    expression = '2 + 2 * t'
+  []
+[]
+
+[Materials]
+  [thermal]
+    type = ADGenericConstantMaterial
+    prop_names = 'thermal_conductivity specific_heat density'
+    prop_values = '10 1 1'
+  []
+  [heat_source]
+    type = FunctionPathDiffusedEllipsoidHeatSource
+    function_path_x = torch_x
+    path_y = 0.5
+    path_z = 1
+    rx = 0.5
+    ry = 0.5
+    rz = 0.3
+    power = 100
+    va = 0.37
+  []
+[]
+
+[Adaptivity]
+  marker = torch
+  max_h_level = 2
+  initial_steps = 2
+  # Reach the maximum level ahead of the torch within one time step
+  cycles_per_step = 2
+  [Indicators]
+    [distance]
+      type = TorchDistanceIndicator
+      heat_source = heat_source
+      lag = 0.5
+      lookahead = 1
+      samples = 8
+    []
+  []
+  [Markers]
+    [torch]
+      type = TorchDistanceMarker
+      indicator = distance
+      refine = 2
+      coarsen = 4
+    []
+  []
+[]
+
+[AuxVariables]
+  [h]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [torch_h]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [h]
+    type = ElementLengthAux
+    variable = h
+    method = max
+  []
+  [torch_h]
+    # Size of the elements within an ellipsoid radius of the torch centre, zero elsewhere
+    type = ParsedAux
+    variable = torch_h
+    coupled_variables = h
+    use_xyzt = true
+    expression = 'if(abs(x - 2 - 2 * t) < 0.5 & abs(y - 0.5) < 0.5 & z > 0.7, h, 0)'
+  []
+[]
+
+[Postprocessors]
+  [torch_h]
+    type = ElementExtremeValue
+    variable = torch_h
+    value_type = max
+  []
+  [elements]
+    type = NumElements
+    elem_filter = active
+  []
+  [dofs]
+    type = NumDOFs
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    # Elements refined twice have a diagonal of 0.31, against 0.61 once refined
+    expression = 'torch_h <= 0 | torch_h > 0.4 | elements <= 160 | elements > 2500'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 18
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,122 @@
+# The same NEML model updated one quadrature point at a time and with all
+# quadrature points of an element in one batch must give the same stress and
+# dissipation. The batched material sees the same strain through its own
+# strain calculator.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '0.002 * t'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+  [strain_batch]
+    type = ComputeLagrangianStrain
+    base_name = batch
+  []
+  [stress_batch]
+    type = CauchyStressFromNEML
+    base_name = batch
+    database = plastic.xml
+    model = plastic
+    batch_qps = true
+  []
+[]
+
+[Postprocessors]
+  [sxx]
+    type = MaterialTensorAverage
+    rank_two_tensor = cauchy_stress
+    index_i = 0
+    index_j = 0
+  []
+  [sxx_batch]
+    type = MaterialTensorAverage
+    rank_two_tensor = batch_cauchy_stress
+    index_i = 0
+    index_j = 0
+  []
+  [dissipation]
+    type = ElementAverageMaterialProperty
+    mat_prop = dissipation
+  []
+  [dissipation_batch]
+    type = ElementAverageMaterialProperty
+    mat_prop = batch_dissipation
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'abs(sxx - sxx_batch) > 1e-10 * abs(sxx) | dissipation <= 0 | '
+                 'abs(dissipation - dissipation_batch) > 1e-10 * dissipation'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
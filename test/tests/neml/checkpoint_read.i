@@ -0,0 +1,108 @@
+# Starting from the archive of checkpoint_write.i with the bar held in place
+# keeps the plastic stress and hardening reached there.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = DirichletBC
+    variable = disp_x
+    boundary = right
+    value = 0
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+    initial_state = checkpoint_state
+  []
+[]
+
+[AuxVariables]
+  [alpha]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [alpha]
+    type = NEMLStateAux
+    variable = alpha
+    material = stress
+    state_variable = alpha
+  []
+[]
+
+[Postprocessors]
+  [sxx]
+    type = MaterialTensorAverage
+    rank_two_tensor = cauchy_stress
+    index_i = 0
+    index_j = 0
+  []
+  [alpha]
+    type = ElementAverageValue
+    variable = alpha
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'sxx < 200 | alpha <= 0'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,114 @@
+# Loading into the plastic range and then holding writes the NEML state of
+# all elements in the first steps and nothing while the state does not change.
+# checkpoint_read.i starts from the archive.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = 'min(0.002 * t, 0.004)'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+[]
+
+[UserObjects]
+  [checkpoint]
+    type = NEMLStateCheckpoint
+    file = checkpoint_state
+    compress = true
+  []
+  [check]
+    type = Terminator
+    expression = 'time < 2.5 & records_written < 8 | time > 2.5 & records_written > 0'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Postprocessors]
+  [time]
+    type = TimePostprocessor
+  []
+  [records_written]
+    type = ObjectStatistic
+    user_object = checkpoint
+    statistic = records_written
+  []
+  [records_unchanged]
+    type = ObjectStatistic
+    user_object = checkpoint
+    statistic = records_unchanged
+  []
+  [bytes_written]
+    type = ObjectStatistic
+    user_object = checkpoint
+    statistic = bytes_written
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-4
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,142 @@
+# Pulling into the plastic range, unloading and then holding the bar with tiny
+# strain increments must give the same stress and dissipation whether the
+# quiescent steps are updated with the full NEML model or with the elastic
+# predictor. The predicted material sees the same strain through its own strain
+# calculator.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = 'if(t <= 2, 0.002 * t, if(t <= 3, 0.004 - 0.001 * (t - 2), 0.003 + 1e-7 * (t - 3)))'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+  [strain_predicted]
+    type = ComputeLagrangianStrain
+    base_name = predicted
+  []
+  [stress_predicted]
+    type = CauchyStressFromNEML
+    base_name = predicted
+    database = plastic.xml
+    model = plastic
+    elastic_predictor = true
+  []
+[]
+
+[Postprocessors]
+  [time]
+    type = TimePostprocessor
+  []
+  [sxx]
+    type = MaterialTensorAverage
+    rank_two_tensor = cauchy_stress
+    index_i = 0
+    index_j = 0
+  []
+  [sxx_predicted]
+    type = MaterialTensorAverage
+    rank_two_tensor = predicted_cauchy_stress
+    index_i = 0
+    index_j = 0
+  []
+  [dissipation]
+    type = ElementAverageMaterialProperty
+    mat_prop = dissipation
+  []
+  [dissipation_predicted]
+    type = ElementAverageMaterialProperty
+    mat_prop = predicted_dissipation
+  []
+  [predicted_points]
+    type = ObjectStatistic
+    material = stress_predicted
+    statistic = predicted_points
+  []
+  [updated_points]
+    type = ObjectStatistic
+    material = stress_predicted
+    statistic = updated_points
+  []
+  [predicted_fraction]
+    type = ParsedPostprocessor
+    expression = 'predicted_points / (predicted_points + updated_points)'
+    pp_names = 'predicted_points updated_points'
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'abs(sxx - sxx_predicted) > 1e-8 * abs(sxx) | '
+                 'abs(dissipation - dissipation_predicted) > 1e-8 * abs(dissipation) | '
+                 'time > 3.5 & predicted_fraction < 0.5'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 8
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
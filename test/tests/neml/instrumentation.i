@@ -0,0 +1,134 @@
+# Call counts and wall time of the NEML stress material and of the state
+# reset, reduced over processors to show load imbalance.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[AuxVariables]
+  [temperature]
+  []
+[]
+
+[ICs]
+  [temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '1000 * x'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+[]
+
+[UserObjects]
+  [reset]
+    type = NEMLMaterialPropertyReset
+    variable = temperature
+    material = stress
+    properties = alpha
+    critical_value = 900
+  []
+  [check]
+    type = Terminator
+    expression = 'stress_calls < 64 | reset_calls != 64 | time_min > time_mean | '
+                 'time_mean > time_max | failures > 0'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Postprocessors]
+  [stress_calls]
+    type = ObjectStatistic
+    material = stress
+    statistic = calls
+  []
+  [time_min]
+    type = ObjectStatistic
+    material = stress
+    statistic = time
+    reduction = rank_min
+  []
+  [time_mean]
+    type = ObjectStatistic
+    material = stress
+    statistic = time
+    reduction = rank_mean
+  []
+  [time_max]
+    type = ObjectStatistic
+    material = stress
+    statistic = time
+    reduction = rank_max
+  []
+  [failures]
+    type = ObjectStatistic
+    material = stress
+    statistic = neml_failures
+  []
+  [reset_calls]
+    type = ObjectStatistic
+    user_object = reset
+    statistic = calls
+  []
+  [reset_time]
+    type = ObjectStatistic
+    user_object = reset
+    statistic = time
+    reduction = rank_max
+  []
+[]
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
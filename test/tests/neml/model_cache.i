@@ -0,0 +1,141 @@
+# NEMLStateAux objects and a NEML stress material using the same model, given
+# either by database and model or by the material. The model must be parsed
+# once per thread, and the startup time and memory use are reported.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[AuxVariables]
+  [alpha_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [alpha_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [alpha_2]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [alpha_0]
+    type = NEMLStateAux
+    variable = alpha_0
+    database = plastic.xml
+    model = plastic
+    state_variable = alpha
+  []
+  [alpha_1]
+    type = NEMLStateAux
+    variable = alpha_1
+    database = plastic.xml
+    model = plastic
+    state_variable = alpha
+  []
+  [alpha_2]
+    type = NEMLStateAux
+    variable = alpha_2
+    material = stress
+    state_variable = alpha
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '0.002 * t'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+[]
+
+[Postprocessors]
+  [models_parsed]
+    type = NEMLModelsParsed
+    per_thread = true
+  []
+  [startup_time]
+    type = PerfGraphData
+    section_name = 'MooseApp::setup'
+    data_type = TOTAL
+  []
+  [memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'models_parsed > 1'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,112 @@
+# A temperature field rising linearly to 1000 along x resets the hardening of
+# the quadrature points at or above 900. Only the last layer of elements can
+# reach the threshold: its 16 elements reset 4 quadrature points each and the
+# other 48 elements are skipped.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 4
+  nz = 4
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[AuxVariables]
+  [temperature]
+  []
+[]
+
+[ICs]
+  [temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '1000 * x'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+  []
+[]
+
+[UserObjects]
+  [reset]
+    type = NEMLMaterialPropertyReset
+    variable = temperature
+    material = stress
+    properties = alpha
+    critical_value = 900
+  []
+  [check]
+    type = Terminator
+    expression = 'resets != 64 | consts != 0 | skipped != 48'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Postprocessors]
+  [resets]
+    type = ObjectStatistic
+    user_object = reset
+    statistic = reset
+  []
+  [consts]
+    type = ObjectStatistic
+    user_object = reset
+    statistic = const
+  []
+  [skipped]
+    type = ObjectStatistic
+    user_object = reset
+    statistic = skipped_elements
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
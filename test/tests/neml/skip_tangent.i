@@ -0,0 +1,99 @@
+# With PJFNK most evaluations are residual-only, and the NEML tangent must
+# only be recombined for the Jacobian (preconditioner) evaluations.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '0.002 * t'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = plastic.xml
+    model = plastic
+    skip_residual_tangent = true
+  []
+[]
+
+[Postprocessors]
+  [tangents_computed]
+    type = ObjectStatistic
+    material = stress
+    statistic = tangents_computed
+  []
+  [tangents_skipped]
+    type = ObjectStatistic
+    material = stress
+    statistic = tangents_skipped
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'tangents_computed <= 0 | tangents_skipped <= tangents_computed'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,164 @@
+# Several NEML state variables pulled into the components of one array
+# variable in a single pass must match NEMLStateAux, which pulls one variable
+# per aux kernel. The model hardens isotropically (alpha) and kinematically
+# (backstress), so each component is compared with a different variable.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    new_system = true
+    formulation = TOTAL
+    add_variables = true
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '0.002 * t'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Materials]
+  [stress]
+    type = CauchyStressFromNEML
+    database = kinematic.xml
+    model = kinematic
+  []
+[]
+
+[AuxVariables]
+  [state]
+    order = CONSTANT
+    family = MONOMIAL
+    components = 2
+  []
+  [state_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [state_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [alpha]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [backstress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [state]
+    type = NEMLStateArrayAux
+    variable = state
+    material = stress
+    state_variables = 'alpha backstress_xx'
+  []
+  [state_0]
+    type = ArrayVariableComponent
+    variable = state_0
+    array_variable = state
+    component = 0
+  []
+  [state_1]
+    type = ArrayVariableComponent
+    variable = state_1
+    array_variable = state
+    component = 1
+  []
+  [alpha]
+    type = NEMLStateAux
+    variable = alpha
+    material = stress
+    state_variable = alpha
+  []
+  [backstress]
+    type = NEMLStateAux
+    variable = backstress
+    material = stress
+    state_variable = backstress_xx
+  []
+[]
+
+[Postprocessors]
+  [alpha]
+    type = ElementAverageValue
+    variable = alpha
+  []
+  [backstress]
+    type = ElementAverageValue
+    variable = backstress
+  []
+  [state_0]
+    type = ElementAverageValue
+    variable = state_0
+  []
+  [state_1]
+    type = ElementAverageValue
+    variable = state_1
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'alpha <= 0 | backstress <= 0 | abs(state_0 - alpha) > 1e-12 * alpha | '
+                 'abs(state_1 - backstress) > 1e-12 * backstress'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
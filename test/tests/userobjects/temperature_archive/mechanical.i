@@ -0,0 +1,78 @@
+# Reads the archive of thermal.i with half its time step. The temperature
+# interpolated between frames must match the function the thermal run wrote,
+# at the steps that fall on a frame and at the steps in between.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [temperature]
+  []
+  [exact]
+  []
+[]
+
+[Functions]
+  [temperature]
+    type = ParsedFunction
+    expression = '300 + 100 * t * (1 + x) + 10 * y'
+  []
+[]
+
+[AuxKernels]
+  [temperature]
+    type = TemperatureArchiveAux
+    variable = temperature
+    reader = archive
+  []
+  [exact]
+    type = FunctionAux
+    variable = exact
+    function = temperature
+    execute_on = 'initial timestep_begin'
+  []
+[]
+
+[UserObjects]
+  [archive]
+    type = TemperatureArchiveReader
+    file = thermal_temperature.bin
+  []
+  [check]
+    type = Terminator
+    expression = 'error > 1e-10 | frames < 5'
+    fail_mode = HARD
+    error_level = ERROR
+  []
+[]
+
+[Postprocessors]
+  [error]
+    type = ElementL2Difference
+    variable = temperature
+    other_variable = exact
+  []
+  [frames]
+    type = ObjectStatistic
+    user_object = archive
+    statistic = frames
+  []
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 4
+  dt = 0.5
+[]
+
+[Outputs]
+  csv = true
+[]
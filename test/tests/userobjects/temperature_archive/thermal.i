@@ -0,0 +1,62 @@
+# Stands in for the thermal run of a sequentially coupled weld: the nodal
+# temperature of each time step is appended to an archive that mechanical.i
+# reads. The temperature is linear in time, so that its interpolation between
+# frames is exact.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [T]
+  []
+[]
+
+[Functions]
+  [temperature]
+    type = ParsedFunction
+    expression = '300 + 100 * t * (1 + x) + 10 * y'
+  []
+[]
+
+[AuxKernels]
+  [T]
+    type = FunctionAux
+    variable = T
+    function = temperature
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[UserObjects]
+  [archive]
+    type = TemperatureArchiveWriter
+    variable = T
+    file = thermal_temperature.bin
+  []
+[]
+
+[Postprocessors]
+  [nodes]
+    type = ObjectStatistic
+    user_object = archive
+    statistic = nodes
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,17 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+/**
+ * Number of heap allocations through operator new by all threads of the unit
+ * test executable so far. The global operator new is replaced in
+ * AllocationCounter.C to count them.
+ */
+unsigned long allocationCount();
@@ -0,0 +1,34 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+
+/**
+ * Performance benchmarks of the unit tests. They check wall clock throughputs
+ * and allocation counts against unit/benchmarks/material_point_baseline.txt,
+ * so they only run when TG4_RUN_BENCHMARKS is set, as the benchmarks test spec
+ * under test/tests does. Measurements go to the properties of the test report.
+ */
+namespace Benchmark
+{
+/// Whether TG4_RUN_BENCHMARKS is set
+bool enabled();
+
+/// Record a measurement in the test report
+void record(const std::string & key, Real value);
+
+///@{ Record a measurement and check it against its bound in the baseline
+void expectAtLeast(const std::string & key, Real value);
+void expectAtMost(const std::string & key, Real value);
+///@}
+}